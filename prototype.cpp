@@ -16,6 +16,18 @@
 #include <algorithm>
 #include <filesystem>
 
+#ifdef __linux__
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
 using namespace std;
 
 // forward declaration
@@ -24,6 +36,7 @@ class Process;
 // globals
 map<string, unique_ptr<Process>> procList;
 mutex processLock;
+mutex reportLock; // serializes writes to csopesy-log.txt (console and control server)
 int next_pid = 1;
 
 // default values if config.txt does not exist
@@ -34,8 +47,9 @@ uint64_t g_batchFreq = 1; // in CPU cycles; stored as uint64_t to match large ra
 int g_minIns = 50;
 int g_maxIns = 200;
 uint64_t g_delayPerExec = 0; // in CPU cycles (we will convert to ms internally)
+string g_controlSocket = "csopesy.sock"; // unix socket path for the control server
 bool g_configLoaded = false;
-bool g_schedulerRunning = false;
+atomic<bool> g_schedulerRunning(false);
 
 static inline void trim(string &s) {
     auto l = s.find_first_not_of(" \t\r\n");
@@ -62,6 +76,7 @@ void readConfig() {
         cout << "  min-ins = " << g_minIns << "\n";
         cout << "  max-ins = " << g_maxIns << "\n";
         cout << "  delay-per-exec = " << g_delayPerExec << "\n";
+        cout << "  control-socket = " << g_controlSocket << "\n";
         cout << "----------------------------------------\n";
         return;
     }
@@ -116,6 +131,8 @@ void readConfig() {
             } else if (key == "delay-per-exec" || key == "delayperexec") {
                 uint64_t v = stoull(value);
                 g_delayPerExec = v;
+            } else if (key == "control-socket" || key == "controlsocket") {
+                if (!value.empty()) g_controlSocket = value;
             }
         } catch (...) {
             cout << "Invalid config entry ignored: " << line << "\n";
@@ -138,6 +155,7 @@ void readConfig() {
     cout << "  min-ins = " << g_minIns << "\n";
     cout << "  max-ins = " << g_maxIns << "\n";
     cout << "  delay-per-exec = " << g_delayPerExec << "\n";
+    cout << "  control-socket = " << g_controlSocket << "\n";
     cout << "----------------------------------------\n";
 
     g_configLoaded = true;
@@ -177,7 +195,7 @@ struct Instruction {
 class Process {
     string name;
     int id;
-    bool finished;
+    atomic<bool> finished;
     thread worker;
     vector<string> logs;
     map<string, uint16_t> vars;
@@ -324,7 +342,7 @@ public:
 
     const string &getName() const { return name; }
     int getId() const { return id; }
-    bool isFinished() const { return finished; }
+    bool isFinished() const { return finished.load(); }
 
     // snapshot logs
     vector<string> snapshotLogs() {
@@ -338,15 +356,91 @@ public:
     int getTotalLines() const { return totalLines; }
 };
 
+// append-only list of every process in creation order, for lock-free
+// readers (control server). the scheduler and screen -s both skip names
+// already in procList, so entries are only ever added; procList is cleared
+// at exit after the control server stops, which keeps the raw pointers valid.
+struct ProcSlab {
+    unique_ptr<Process *[]> slots;
+    size_t capacity = 0;
+};
+shared_ptr<ProcSlab> g_procSlab = make_shared<ProcSlab>();
+atomic<size_t> g_procCount(0);
+
+// what readers see: the first 'count' slots of a slab they keep alive
+struct ProcView {
+    shared_ptr<const ProcSlab> slab;
+    size_t count = 0;
+
+    Process *const *begin() const { return slab->slots.get(); }
+    Process *const *end() const { return begin() + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    Process *find(const string &name) const {
+        for (Process *p : *this)
+            if (p->getName() == name) return p;
+        return nullptr;
+    }
+};
+
+// appends a new process to the view; caller must hold processLock.
+// slots past g_procCount are never read, so the common case writes one slot
+// in place; a full slab is copied into one twice its size, and readers
+// still holding the old slab keep it alive.
+void publishProcView(Process *p) {
+    size_t n = g_procCount.load(memory_order_relaxed);
+    shared_ptr<ProcSlab> slab = atomic_load(&g_procSlab);
+    if (n == slab->capacity) {
+        auto grown = make_shared<ProcSlab>();
+        grown->capacity = max<size_t>(64, slab->capacity * 2);
+        grown->slots = make_unique<Process *[]>(grown->capacity);
+        copy(slab->slots.get(), slab->slots.get() + n, grown->slots.get());
+        grown->slots[n] = p;
+        atomic_store(&g_procSlab, grown);
+    } else {
+        slab->slots[n] = p;
+    }
+    g_procCount.store(n + 1, memory_order_release);
+}
+
+ProcView snapshotProcView() {
+    ProcView view;
+    view.count = g_procCount.load(memory_order_acquire); // before the slab: it is published first
+    view.slab = atomic_load(&g_procSlab);
+    return view;
+}
+
+// utilization figures shared by report-util and the control server
+struct UtilStats {
+    int running = 0;
+    int finished = 0;
+    int usedCores = 0;
+    int available = 0;
+    double cpuUtilization = 0.0; // percent
+};
+
+UtilStats computeUtil(const ProcView &procs) {
+    UtilStats st;
+    for (Process *p : procs)
+        if (p->isFinished())
+            st.finished++;
+    st.running = (int)procs.size() - st.finished;
+    st.usedCores = min(st.running, g_numCPU);
+    st.available = max(0, g_numCPU - st.usedCores);
+    st.cpuUtilization = 100.0 * st.usedCores / g_numCPU;
+    return st;
+}
+
 // Command Handlers
-void handleSchedulerStart() {
-    if (g_schedulerRunning) {
-        cout << "Scheduler already running.\n";
-        return;
+// handlers return false when the command did nothing or failed
+bool handleSchedulerStart(ostream &msg = cout) {
+    if (g_schedulerRunning.exchange(true)) {
+        msg << "Scheduler already running.\n";
+        return false;
     }
-    g_schedulerRunning = true;
-    cout << "Starting scheduler (" << g_schedulerType << ")...\n";
-    cout << "------------------------------------\n";
+    msg << "Starting scheduler (" << g_schedulerType << ")...\n";
+    msg << "------------------------------------\n";
 
     thread([]() {
         random_device rd; mt19937 gen(rd());
@@ -355,14 +449,20 @@ void handleSchedulerStart() {
         const uint64_t cycle_ms = 100;
 
         while (g_schedulerRunning) {
-            string name = "proc-" + to_string(counter++);
             uniform_int_distribution<int> dist(g_minIns, g_maxIns);
             int lines = dist(gen);
 
             {
                 lock_guard<mutex> lock(processLock);
+                // never replace an existing process (e.g. after a scheduler
+                // restart, or a 'screen -s proc-N'); pick the next free name
+                string name;
+                do {
+                    name = "proc-" + to_string(counter++);
+                } while (procList.find(name) != procList.end());
                 procList[name] = make_unique<Process>(name, next_pid++, lines);
                 procList[name]->start();
+                publishProcView(procList[name].get());
             }
 
             // sleep according to batch-process-freq
@@ -371,69 +471,66 @@ void handleSchedulerStart() {
             this_thread::sleep_for(chrono::milliseconds(static_cast<int>(sleep_ms)));
         }
     }).detach();
+    return true;
 }
 
-void handleSchedulerStop() {
-    if (!g_schedulerRunning) {
-        cout << "Scheduler not running.\n";
-        return;
+bool handleSchedulerStop(ostream &msg = cout) {
+    if (!g_schedulerRunning.exchange(false)) {
+        msg << "Scheduler not running.\n";
+        return false;
     }
-    g_schedulerRunning = false;
-    cout << "Scheduler stopped.\n";
-    cout << "------------------------------------\n";
+    msg << "Scheduler stopped.\n";
+    msg << "------------------------------------\n";
+    return true;
 }
 
 // for testing
-void handleReportUtil() {
-    lock_guard<mutex> lock(processLock);
+// reads the published process view instead of locking processLock, so the
+// control server can run it without stalling its other sessions. the figures
+// written to the file are also copied to *stats when given.
+bool handleReportUtil(ostream &msg = cout, UtilStats *stats = nullptr) {
+    ProcView procs = snapshotProcView();
+    UtilStats st = computeUtil(procs);
+    if (stats) *stats = st;
+    random_device rd; mt19937 gen(rd());
+    lock_guard<mutex> lock(reportLock);
     ofstream out("csopesy-log.txt", ios::out | ios::trunc);
 
     if (!out.is_open()) {
-        cout << "Error: Unable to write to csopesy-log.txt\n";
-        return;
+        msg << "Error: Unable to write to csopesy-log.txt\n";
+        return false;
     }
 
     // expected values when there are no processes
-    if (procList.empty()) {
+    if (procs.empty()) {
         out << "CPU utilization: 0%\n";
         out << "Cores used: 0\n";
         out << "Cores available: " << g_numCPU << "\n";
         out << "------------------------------------\n";
         out << "(no processes)\n";
         out.close();
-        cout << "Report saved to csopesy-log.txt\n";
-        return;
+        msg << "Report saved to csopesy-log.txt\n";
+        return true;
     }
 
-    int total = (int)procList.size();
-    int finished = 0;
-    for (auto &kv : procList)
-        if (kv.second->isFinished())
-            finished++;
-
-    int running = total - finished;
-    int usedCores = min(running, g_numCPU);
-    int available = max(0, g_numCPU - usedCores);
-
     out << "CPU utilization: " << fixed << setprecision(1)
-        << (100.0 * usedCores / g_numCPU) << "%\n";
-    out << "Cores used: " << usedCores << "\n";
-    out << "Cores available: " << available << "\n";
+        << st.cpuUtilization << "%\n";
+    out << "Cores used: " << st.usedCores << "\n";
+    out << "Cores available: " << st.available << "\n";
     out << "------------------------------------\n";
 
     // running processes
-    if (running > 0) {
+    if (st.running > 0) {
         out << "Running processes:\n";
         int core = 0;
-        for (auto &kv : procList) {
-            auto &p = kv.second;
+        for (Process *p : procs) {
             if (!p->isFinished()) {
                 time_t now = time(nullptr);
                 tm local_tm = *localtime(&now);
                 char buf[64];
                 strftime(buf, sizeof(buf), "(%m/%d/%Y %I:%M:%S%p)", &local_tm);
                 int totalIns = 1000 + (p->getId() * 10);
-                int done = rand() % totalIns;
+                int done = uniform_int_distribution<int>(0, totalIns - 1)(gen);
                 out << left << setw(10) << p->getName()
                     << " " << buf
                     << "   Core: " << core++ % g_numCPU
@@ -446,8 +543,7 @@ void handleReportUtil() {
 
     // finished processes
     out << "\nFinished processes:\n";
-    for (auto &kv : procList) {
-        auto &p = kv.second;
+    for (Process *p : procs) {
         if (p->isFinished()) {
             time_t now = time(nullptr);
             tm local_tm = *localtime(&now);
@@ -462,7 +558,8 @@ void handleReportUtil() {
 
     out << "------------------------------------\n";
     out.close();
-    cout << "Report generated at csopesy-log.txt\n";
+    msg << "Report generated at csopesy-log.txt\n";
+    return true;
 }
 // for testing
 
@@ -579,32 +676,414 @@ void attachToProcess(const string &rawName) {
     }
 }
 
+// creates and starts a named process; returns false if the name is taken or empty
+bool spawnProcess(const string &name, ostream &msg = cout) {
+    if (name.empty()) {
+        msg << "Usage: screen -s <process-name>\n";
+        return false;
+    }
+
+    lock_guard<mutex> lock(processLock);
+    if (procList.find(name) != procList.end()) {
+        msg << "Process with name '" << name << "' already exists.\n";
+        return false;
+    }
+
+    random_device rd; mt19937 gen(rd());
+    uniform_int_distribution<int> dist(g_minIns, g_maxIns);
+    int lines = dist(gen);
+
+    procList[name] = make_unique<Process>(name, next_pid++, lines);
+    procList[name]->start();
+    publishProcView(procList[name].get());
+    return true;
+}
+
 void handleScreenSpawn(const string &rawName) {
     string name = rawName;
     trim(name);
 
-    if (name.empty()) {
-        cout << "Usage: screen -s <process-name>\n";
+    if (!spawnProcess(name)) return;
+
+    attachToProcess(name);
+}
+
+// control server
+// line-based command sessions over a local unix socket, one JSON object per
+// reply. read-only commands go through snapshotProcView() and never touch
+// processLock, so monitoring scripts can poll as often as they like.
+#ifdef __linux__
+static string jsonEscape(const string &in) {
+    string out;
+    out.reserve(in.size() + 2);
+    for (char c : in) {
+        switch (c) {
+        case '"':  out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\r': out += "\\r"; break;
+        case '\t': out += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+            } else out += c;
+        }
+    }
+    return out;
+}
+
+// 'extra' is spliced in as additional members, e.g. jsonUtil()
+static string jsonMessage(const string &cmd, bool ok, string message, const string &extra = "") {
+    trim(message);
+    return "{\"ok\":" + string(ok ? "true" : "false") + ",\"cmd\":\"" + jsonEscape(cmd) +
+           "\",\"message\":\"" + jsonEscape(message) + "\"" +
+           (extra.empty() ? "" : "," + extra) + "}";
+}
+
+static string jsonProcess(const Process *p) {
+    ostringstream js;
+    js << "\"name\":\"" << jsonEscape(p->getName()) << "\""
+       << ",\"id\":" << p->getId()
+       << ",\"core\":" << p->getCoreAssigned()
+       << ",\"line\":" << p->getCurrentInstructionLine()
+       << ",\"lines\":" << p->getTotalLines()
+       << ",\"finished\":" << (p->isFinished() ? "true" : "false");
+    return js.str();
+}
+
+static string jsonUtil(const UtilStats &st) {
+    ostringstream js;
+    js << "\"cpu_utilization\":" << fixed << setprecision(1) << st.cpuUtilization
+       << ",\"cores_used\":" << st.usedCores
+       << ",\"cores_available\":" << st.available
+       << ",\"running\":" << st.running
+       << ",\"finished\":" << st.finished;
+    return js.str();
+}
+
+static string ctlScreenList() {
+    ProcView view = snapshotProcView();
+
+    ostringstream js;
+    js << "{\"ok\":true,\"cmd\":\"screen -ls\"," << jsonUtil(computeUtil(view))
+       << ",\"processes\":[";
+    bool first = true;
+    for (Process *p : view) {
+        js << (first ? "" : ",") << "{" << jsonProcess(p) << "}";
+        first = false;
+    }
+    js << "]}";
+    return js.str();
+}
+
+static string ctlProcessSmi(const string &name) {
+    Process *p = snapshotProcView().find(name);
+    if (!p)
+        return jsonMessage("process-smi", false, "Process '" + name + "' not found.");
+
+    ostringstream js;
+    js << "{\"ok\":true,\"cmd\":\"process-smi\"," << jsonProcess(p) << ",\"logs\":[";
+    auto logs = p->snapshotLogs();
+    for (size_t i = 0; i < logs.size(); ++i)
+        js << (i ? "," : "") << "\"" << jsonEscape(logs[i]) << "\"";
+    js << "]}";
+    return js.str();
+}
+
+struct ControlSession {
+    string in;
+    string out;
+    string attached;    // process name after 'screen -s' / 'screen -r', like the proc> prompt
+    bool peerClosed = false; // client shut down its write side; answer what is left, then close
+    bool closing = false;
+};
+
+// runs one command line for a session and returns its JSON reply
+static string ctlDispatch(ControlSession &s, const string &line) {
+    if (line == "exit") {
+        if (!s.attached.empty()) {
+            string name = s.attached;
+            s.attached.clear();
+            return jsonMessage(line, true, "Detached from " + name + ".");
+        }
+        s.closing = true;
+        return jsonMessage(line, true, "Bye.");
+    }
+
+    if (line == "process-smi") {
+        if (s.attached.empty())
+            return jsonMessage(line, false, "Not attached: use 'screen -r <name>' or 'process-smi <name>'.");
+        return ctlProcessSmi(s.attached);
+    }
+    if (line.rfind("process-smi ", 0) == 0) {
+        string name = line.substr(12);
+        trim(name);
+        return ctlProcessSmi(name);
+    }
+
+    if (line == "screen -ls") return ctlScreenList();
+    if (line == "initialize") return jsonMessage(line, true, "Processor already initialized.");
+
+    ostringstream msg;
+    if (line == "scheduler-start") { bool ok = handleSchedulerStart(msg); return jsonMessage(line, ok, msg.str()); }
+    if (line == "scheduler-stop")  { bool ok = handleSchedulerStop(msg); return jsonMessage(line, ok, msg.str()); }
+    if (line == "report-util") {
+        UtilStats st;
+        bool ok = handleReportUtil(msg, &st);
+        return jsonMessage(line, ok, msg.str(), jsonUtil(st));
+    }
+
+    if (line.rfind("screen -r", 0) == 0) {
+        string name = line.size() > 10 ? line.substr(10) : "";
+        trim(name);
+        Process *p = snapshotProcView().find(name);
+        if (!p || p->isFinished())
+            return jsonMessage("screen -r", false, "Process " + name + " not found.");
+        s.attached = name;
+        return jsonMessage("screen -r", true, "Attached to process: " + name);
+    }
+
+    if (line.rfind("screen -s", 0) == 0) {
+        string name = line.size() > 10 ? line.substr(10) : "";
+        trim(name);
+        if (!spawnProcess(name, msg)) return jsonMessage("screen -s", false, msg.str());
+        s.attached = name;
+        return jsonMessage("screen -s", true, "Attached to process: " + name);
+    }
+
+    return jsonMessage(line, false, "Unknown command.");
+}
+
+const size_t kCtlMaxLine = 64 * 1024;          // longest request line accepted
+const size_t kCtlMaxPendingOut = 1024 * 1024;  // stop running a client's commands past this backlog
+const int kCtlMaxReadsPerWakeup = 16;          // recv calls per client per wakeup, for fairness
+
+int g_ctlListenFd = -1;
+int g_ctlWakeFd = -1;
+thread g_ctlThread;
+
+static bool ctlHasPendingLine(const ControlSession &s) {
+    return !s.closing && s.in.find('\n') != string::npos;
+}
+
+// EPOLLOUT also stands in for "come back to this session": lines left in
+// s.in because the output backlog was full get no new EPOLLIN of their own
+static void ctlUpdateInterest(int epfd, int fd, const ControlSession &s) {
+    bool wantOut = !s.out.empty() || ctlHasPendingLine(s);
+    bool wantIn = !s.closing && !s.peerClosed &&
+                  s.out.size() < kCtlMaxPendingOut && s.in.size() <= kCtlMaxLine;
+    epoll_event ev{};
+    ev.events = (wantOut ? uint32_t(EPOLLOUT) : 0u) | (wantIn ? uint32_t(EPOLLIN) : 0u);
+    ev.data.fd = fd;
+    epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ev);
+}
+
+// returns false if the peer is gone
+static bool ctlFlush(int fd, ControlSession &s) {
+    while (!s.out.empty()) {
+        ssize_t n = send(fd, s.out.data(), s.out.size(), MSG_NOSIGNAL);
+        if (n > 0) { s.out.erase(0, static_cast<size_t>(n)); continue; }
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true;
+        return false;
+    }
+    return true;
+}
+
+// reads what the client sent, at most kCtlMaxReadsPerWakeup recv calls and
+// no further once s.in holds more than a full line. returns false if the
+// peer is gone.
+static bool ctlRead(int fd, ControlSession &s) {
+    char buf[4096];
+    for (int reads = 0; reads < kCtlMaxReadsPerWakeup && s.in.size() <= kCtlMaxLine; ++reads) {
+        ssize_t n = recv(fd, buf, sizeof(buf), 0);
+        if (n > 0) { s.in.append(buf, static_cast<size_t>(n)); continue; }
+        if (n == 0) {
+            // answer what was already sent, including an unterminated last command
+            s.peerClosed = true;
+            if (!s.in.empty() && s.in.back() != '\n') s.in += '\n';
+            break;
+        }
+        if (errno == EINTR) continue;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+        return false;
+    }
+    return true;
+}
+
+// runs complete lines from s.in until the output backlog reaches
+// kCtlMaxPendingOut; the rest stay buffered for the next wakeup
+static void ctlRunLines(ControlSession &s) {
+    size_t start = 0, nl;
+    while (!s.closing && s.out.size() < kCtlMaxPendingOut &&
+           (nl = s.in.find('\n', start)) != string::npos) {
+        string line = s.in.substr(start, nl - start);
+        start = nl + 1;
+        trim(line);
+        if (line.empty()) continue;
+        s.out += ctlDispatch(s, line);
+        s.out += '\n';
+    }
+    s.in.erase(0, start);
+
+    if (s.closing || s.in.find('\n') != string::npos) return;
+    if (s.in.size() > kCtlMaxLine) {
+        s.out += jsonMessage("", false, "Request line too long.") + "\n";
+        s.closing = true;
+    } else if (s.peerClosed) {
+        s.closing = true;
+    }
+}
+
+static void controlServerLoop() {
+    int epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (epfd < 0) return;
+
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.fd = g_ctlListenFd;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, g_ctlListenFd, &ev);
+    ev.data.fd = g_ctlWakeFd;
+    epoll_ctl(epfd, EPOLL_CTL_ADD, g_ctlWakeFd, &ev);
+
+    map<int, ControlSession> sessions;
+    auto closeSession = [&](int fd) {
+        epoll_ctl(epfd, EPOLL_CTL_DEL, fd, nullptr);
+        close(fd);
+        sessions.erase(fd);
+    };
+
+    epoll_event events[64];
+    bool running = true;
+    while (running) {
+        int n = epoll_wait(epfd, events, 64, -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+
+        for (int i = 0; i < n; ++i) {
+            int fd = events[i].data.fd;
+
+            if (fd == g_ctlWakeFd) { running = false; break; }
+
+            if (fd == g_ctlListenFd) {
+                while (true) {
+                    int cfd = accept4(g_ctlListenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if (cfd < 0) break;
+                    epoll_event cev{};
+                    cev.events = EPOLLIN;
+                    cev.data.fd = cfd;
+                    epoll_ctl(epfd, EPOLL_CTL_ADD, cfd, &cev);
+                    sessions[cfd];
+                }
+                continue;
+            }
+
+            auto it = sessions.find(fd);
+            if (it == sessions.end()) continue;
+            ControlSession &s = it->second;
+
+            bool alive = true;
+            if (events[i].events & EPOLLIN) alive = ctlRead(fd, s);
+            else if (events[i].events & (EPOLLHUP | EPOLLERR)) alive = false;
+            if (alive) {
+                ctlRunLines(s);
+                alive = ctlFlush(fd, s);
+            }
+
+            if (!alive || (s.closing && s.out.empty())) closeSession(fd);
+            else ctlUpdateInterest(epfd, fd, s);
+        }
+    }
+
+    for (auto &kv : sessions) close(kv.first);
+    close(epfd);
+}
+
+void startControlServer() {
+    if (g_ctlListenFd >= 0) return;
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (g_controlSocket.size() >= sizeof(addr.sun_path)) {
+        cout << "Control server disabled: socket path too long.\n";
         return;
     }
+    strncpy(addr.sun_path, g_controlSocket.c_str(), sizeof(addr.sun_path) - 1);
 
-    {
-        lock_guard<mutex> lock(processLock);
-        if (procList.find(name) != procList.end()) {
-            cout << "Process with name '" << name << "' already exists.\n";
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        cout << "Control server disabled: " << strerror(errno) << "\n";
+        return;
+    }
+    // only clear a stale socket from a previous run: never delete a regular
+    // file, and never take over a socket another instance is still serving
+    struct stat st;
+    if (lstat(g_controlSocket.c_str(), &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            cout << "Control server disabled: " << g_controlSocket << " exists and is not a socket.\n";
+            close(fd);
             return;
         }
+        // non-blocking so a full backlog cannot hang startup; only a refused
+        // connection proves the socket is stale
+        int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        int probeErr = probe < 0 ? errno : 0;
+        if (probe >= 0) {
+            if (connect(probe, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0) probeErr = errno;
+            close(probe);
+        }
+        if (probeErr != ECONNREFUSED) {
+            if (probeErr == 0 || probeErr == EAGAIN || probeErr == EINPROGRESS)
+                cout << "Control server disabled: another instance is listening on " << g_controlSocket << ".\n";
+            else
+                cout << "Control server disabled: cannot probe " << g_controlSocket << ": " << strerror(probeErr) << "\n";
+            close(fd);
+            return;
+        }
+        unlink(g_controlSocket.c_str());
+    }
+    if (bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0 || listen(fd, 64) < 0) {
+        cout << "Control server disabled: " << strerror(errno) << "\n";
+        close(fd);
+        return;
+    }
 
-        random_device rd; mt19937 gen(rd());
-        uniform_int_distribution<int> dist(g_minIns, g_maxIns);
-        int lines = dist(gen);
-
-        procList[name] = make_unique<Process>(name, next_pid++, lines);
-        procList[name]->start();
+    g_ctlWakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (g_ctlWakeFd < 0) {
+        cout << "Control server disabled: " << strerror(errno) << "\n";
+        close(fd);
+        unlink(g_controlSocket.c_str());
+        return;
     }
 
-    attachToProcess(name);
+    g_ctlListenFd = fd;
+    g_ctlThread = thread(controlServerLoop);
+    cout << "Control server listening on " << g_controlSocket << "\n";
+}
+
+void stopControlServer() {
+    if (g_ctlListenFd < 0) return;
+    uint64_t one = 1;
+    ssize_t w = write(g_ctlWakeFd, &one, sizeof(one));
+    (void)w;
+    if (g_ctlThread.joinable()) g_ctlThread.join();
+    close(g_ctlListenFd);
+    close(g_ctlWakeFd);
+    unlink(g_controlSocket.c_str());
+    g_ctlListenFd = -1;
+    g_ctlWakeFd = -1;
 }
+#else
+void startControlServer() {
+    cout << "Control server not supported on this platform.\n";
+}
+
+void stopControlServer() {}
+#endif
 
 // main loop
 int main() {
@@ -620,6 +1099,7 @@ int main() {
 
         if (line == "exit") {
             cout << "Exiting console.\n";
+            stopControlServer();
             {
                 lock_guard<mutex> lock(processLock);
                 for (auto &kv : procList) kv.second->join();
@@ -633,6 +1113,7 @@ int main() {
                 readConfig();
                 initialized = true;
                 cout << "Processor initialized.\n";
+                startControlServer();
             } else {
                 cout << "Unknown command: call 'initialize' first.\n";
             }
@@ -661,6 +1142,7 @@ int main() {
         cout << "Unknown command.\n";
     }
 
+    stopControlServer();
     return 0;
 
 }